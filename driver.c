@@ -10,8 +10,12 @@
  *    Write: accepts "start", "stop" and "reset" commands to control click counting
  * 
  * 2. /dev/usb_mouse_movements
- *    Read: returns current (x,y) position and latest raw data packet
- *    Write: accepts "start", "stop" and "reset" commands to control movement tracking
+ *    Read: returns raw (x,y) position, transformed cursor position, report sequence number with its
+ *          timestamp and latest raw data packet. Blocking reads wait for the next report and
+ *          reads fail with -ENODEV once the mouse has been disconnected.
+ *    Write: accepts "start", "stop" and "reset" commands to control movement tracking, plus
+ *           profile commands "scale <pct>", "deadzone <counts>", "bounds <w> <h>",
+ *           "curve <speed>:<pct> ..." and "profile default" to configure pointer acceleration
  */
 
 #include <linux/module.h>
@@ -22,6 +26,27 @@
 #include <linux/fs.h>       // For file operations
 #include <linux/cdev.h>     // For character device registeration
 #include <linux/mutex.h>    // For mutex lock
+#include <linux/spinlock.h> // For report state shared with the interrupt handler
+#include <linux/ctype.h>    // For profile command parsing
+#include <linux/wait.h>     // For blocking reads on new reports
+#include <linux/ktime.h>    // For report timestamps
+#include <linux/kref.h>     // For mouse lifetime across open movement files
+#include <linux/list.h>     // For movement device lookup on open
+
+#define ACCEL_LUT_SIZE   256  // Gain table entries, indexed by per-report speed max(|dx|, |dy|) (saturates at last entry)
+#define ACCEL_FP_SHIFT   16   // Fixed point fraction bits (Q16.16) for gains and cursor position
+#define ACCEL_MAX_POINTS 8    // Maximum number of points in a piecewise acceleration curve
+
+// Pointer acceleration profile as configured from userspace
+struct mouse_profile {
+    int scale_pct;      // Linear scale in percent (100 = 1.0x)
+    int deadzone;       // Reports with speed max(|dx|, |dy|) below this are dropped
+    int width;          // Screen bounds for clamping the cursor, 0 disables clamping
+    int height;
+    int curve_n;        // Number of curve points, 0 means flat curve (gain 100%)
+    int curve_speed[ACCEL_MAX_POINTS];
+    int curve_pct[ACCEL_MAX_POINTS];
+};
 
 // USB mouse structure (holds mouse state, data buffers, character devices and sync primitives)
 struct usb_mouse {
@@ -36,39 +61,148 @@ struct usb_mouse {
     int x_pos;
     int y_pos;
 
-    // Click counter char device
-    struct cdev click_cdev;
+    // Click counter char device, allocated separately since open files keep it alive past disconnect
+    struct cdev *click_cdev;
     dev_t click_devt;
     struct class *click_class;
     struct device *click_device;
 
-    // Movement tracking char device
-    struct cdev move_cdev;
+    // Movement tracking char device, allocated separately since open files keep it alive past disconnect
+    struct cdev *move_cdev;
     dev_t move_devt;
     struct class *move_class;
     struct device *move_device;
 
-    // Mutex for movement data read sync
-    struct mutex move_mutex;
+    // Spinlock for movement report state, taken with interrupts disabled since the URB handler runs in atomic context.
+    // Protects last_packet, packet_available, x_pos/y_pos, profile, accel_lut, cursor_* and report_*
+    spinlock_t move_lock;
+
+    // Pointer acceleration profile and its precomputed Q16.16 gain table
+    struct mouse_profile profile;
+    u32 accel_lut[ACCEL_LUT_SIZE];
+    s64 cursor_x;       // Transformed cursor position in Q16.16
+    s64 cursor_y;
+
+    // Report sequence number and CLOCK_MONOTONIC timestamp of the latest report, readers sleep on move_wait
+    u64 report_seq;
+    u64 report_ns;
+    wait_queue_head_t move_wait;
+
+    // Start of the latest report, longer reports are truncated to fit
     unsigned char last_packet[8];
     bool packet_available;
 
+    // Mutex serialising profile writes, config_lut is the table being built before it is copied into accel_lut
+    struct mutex config_mutex;
+    u32 config_lut[ACCEL_LUT_SIZE];
+
+    // Reference held by the USB interface and by each open click or movement file, the last put frees the mouse
+    struct kref kref;
+    struct list_head node;
+
 };
 
 // Global variables
 static struct class *click_class;
 static struct class *move_class;
 
+// Connected mice, used by click_open and move_open to take a reference before disconnect can drop the last one
+static LIST_HEAD(mouse_list);
+static DEFINE_MUTEX(mouse_list_mutex);
+
 static const struct usb_device_id usb_device_table[] = {
     {USB_INTERFACE_INFO(0x03, 0x01, 0x02)},  // Recognise generic USB mouse
     {} // Terminating entry
 };
 MODULE_DEVICE_TABLE(usb, usb_device_table);
 
+static void usb_mouse_free(struct kref *kref)
+{
+    struct usb_mouse *mouse = container_of(kref, struct usb_mouse, kref);
+    kfree(mouse);
+}
+
+// Finds the connected mouse owning a char device number and takes a reference on it
+static struct usb_mouse *usb_mouse_get(dev_t devt)
+{
+    struct usb_mouse *mouse = NULL, *entry;
+
+    mutex_lock(&mouse_list_mutex);
+    list_for_each_entry(entry, &mouse_list, node) {
+        if (entry->click_devt == devt || entry->move_devt == devt) {
+            mouse = entry;
+            kref_get(&mouse->kref);
+            break;
+        }
+    }
+    mutex_unlock(&mouse_list_mutex);
+    return mouse;
+}
+
+static void profile_set_default(struct mouse_profile *profile)
+{
+    memset(profile, 0, sizeof(*profile));
+    profile->scale_pct = 100;
+}
+
+// Interpolates the curve gain (in percent) at a given speed, flat outside the first and last points
+static int profile_curve_pct(const struct mouse_profile *profile, int speed)
+{
+    int i;
+
+    if (profile->curve_n == 0)
+        return 100;
+    if (speed <= profile->curve_speed[0])
+        return profile->curve_pct[0];
+    for (i = 1; i < profile->curve_n; i++) {
+        int s0 = profile->curve_speed[i - 1], s1 = profile->curve_speed[i];
+        int p0 = profile->curve_pct[i - 1], p1 = profile->curve_pct[i];
+        if (speed <= s1)
+            return p0 + (p1 - p0) * (speed - s0) / (s1 - s0);
+    }
+    return profile->curve_pct[profile->curve_n - 1];
+}
+
+// Precomputes the gain for every speed so the interrupt handler only does a lookup and a multiply
+static void profile_build_lut(const struct mouse_profile *profile, u32 *lut)
+{
+    int speed;
+
+    for (speed = 0; speed < ACCEL_LUT_SIZE; speed++) {
+        u64 gain;
+        if (speed < profile->deadzone) {
+            lut[speed] = 0;
+            continue;
+        }
+        gain = (u64)profile->scale_pct * profile_curve_pct(profile, speed);
+        lut[speed] = (u32)div_u64(gain << ACCEL_FP_SHIFT, 100 * 100);
+    }
+}
+
+// Looks up the gain for a report, using one speed for both axes so diagonal moves keep their direction
+static u32 accel_gain(const u32 *lut, int dx, int dy)
+{
+    int speed = max(abs(dx), abs(dy));
+
+    if (speed >= ACCEL_LUT_SIZE)
+        speed = ACCEL_LUT_SIZE - 1;
+    return lut[speed];
+}
+
+// Clamps a Q16.16 cursor coordinate to [0, limit) when limit is set
+static s64 accel_clamp(s64 pos, int limit)
+{
+    if (limit > 0)
+        pos = clamp_t(s64, pos, 0, ((s64)(limit - 1)) << ACCEL_FP_SHIFT);
+    return pos;
+}
+
 static void usb_mouse_irq(struct urb *urb) // Triggered when mouse sends data
 {
     struct usb_mouse *mouse = urb->context;
     int status = urb->status;
+    unsigned long flags;
+    u32 gain;
     if (status == 0 && mouse-> enabled) {
         static int last_left = 0;
         int left_pressed = mouse->data[0] & 0x01;
@@ -81,22 +215,24 @@ static void usb_mouse_irq(struct urb *urb) // Triggered when mouse sends data
         // Track mouse movement
         int16_t dx = (int16_t)((mouse->data[3] << 8) | mouse->data[2]);
         int16_t dy = (int16_t)((mouse->data[5] << 8) | mouse->data[4]);
-        printk(KERN_INFO "Interpreted dx: %d, dy: %d\n", dx, dy);
-        mouse->x_pos += dx;
-        mouse->y_pos -= dy;
 
-        // Check for movement data in kernel logs
-        printk(KERN_INFO "Full Raw Packet:");
-        for (int i = 0; i < 8; i++) {
-            printk(KERN_CONT " 0x%02x", mouse->data[i]);
-        }
-        printk(KERN_CONT "\n");
+        // Movement data in kernel logs only when enabled through dynamic debug, as this runs for every report
+        dev_dbg(&mouse->usbdev->dev, "Interpreted dx: %d, dy: %d, raw packet: %*ph\n",
+                dx, dy, mouse->pkt_len, mouse->data);
 
-        // Save last packet data for movement device and updates availability flag, protected by mutex
-        mutex_lock(&mouse->move_mutex);
-        memcpy(mouse->last_packet, mouse->data, mouse->pkt_len);
+        // Save last packet data and positions for movement device and updates availability flag, protected by spinlock
+        spin_lock_irqsave(&mouse->move_lock, flags);
+        memcpy(mouse->last_packet, mouse->data, min_t(int, mouse->pkt_len, sizeof(mouse->last_packet)));
         mouse->packet_available = true;
-        mutex_unlock(&mouse->move_mutex);
+        mouse->x_pos += dx;
+        mouse->y_pos -= dy;
+        gain = accel_gain(mouse->accel_lut, dx, dy);
+        mouse->cursor_x = accel_clamp(mouse->cursor_x + (s64)dx * gain, mouse->profile.width);
+        mouse->cursor_y = accel_clamp(mouse->cursor_y - (s64)dy * gain, mouse->profile.height);
+        mouse->report_seq++;
+        mouse->report_ns = ktime_get_ns();
+        spin_unlock_irqrestore(&mouse->move_lock, flags);
+        wake_up_interruptible(&mouse->move_wait);
     } else if (status != 0){
         printk(KERN_WARNING "URB error status: %d\n", status);
     }
@@ -108,11 +244,21 @@ static void usb_mouse_irq(struct urb *urb) // Triggered when mouse sends data
 // --- click char device handlers
 static int click_open(struct inode *inode, struct file *file)
 {
-    struct usb_mouse *mouse = container_of(inode->i_cdev, struct usb_mouse, click_cdev);
+    struct usb_mouse *mouse = usb_mouse_get(inode->i_rdev);
+
+    if (!mouse)
+        return -ENODEV;
     file->private_data = mouse;
     return 0;
 }
 
+static int click_release(struct inode *inode, struct file *file)
+{
+    struct usb_mouse *mouse = file->private_data;
+    kref_put(&mouse->kref, usb_mouse_free);
+    return 0;
+}
+
 static ssize_t click_read(struct file *file, char __user *buf, size_t count, loff_t *ppos)
 {
     struct usb_mouse *mouse = file->private_data;
@@ -150,6 +296,7 @@ static ssize_t click_write(struct file *file, const char __user *buf, size_t cou
             mouse->disconnected = true;
             mouse->enabled = false;
             usb_kill_urb(mouse->irq);
+            wake_up_interruptible(&mouse->move_wait);
             printk(KERN_INFO "[Click] User issued DISCONNECT command\n");
 }   } else {
         printk(KERN_WARNING "[Click] Unknown command received: %s\n", buffer);
@@ -163,43 +310,130 @@ static const struct file_operations click_fops = {
     .read = click_read,
     .write = click_write,
     .open = click_open,
+    .release = click_release,
 };
 
 
 // --- movement char device handlers
 static int move_open(struct inode *inode, struct file *file)
 {
-    struct usb_mouse *mouse = container_of(inode->i_cdev, struct usb_mouse, move_cdev);
+    struct usb_mouse *mouse = usb_mouse_get(inode->i_rdev);
+
+    if (!mouse)
+        return -ENODEV;
     file->private_data = mouse;
     return 0;
 }
 
+static int move_release(struct inode *inode, struct file *file)
+{
+    struct usb_mouse *mouse = file->private_data;
+    kref_put(&mouse->kref, usb_mouse_free);
+    return 0;
+}
+
 static ssize_t move_read(struct file *file, char __user *buf, size_t count, loff_t *ppos)
 {
     struct usb_mouse *mouse = file->private_data;
-    char buffer[64];
+    char buffer[192];
+    unsigned long flags;
     int len;
+    u64 seq;
+
+    // Blocking readers wait for a report newer than the one available on entry
+    if (!(file->f_flags & O_NONBLOCK)) {
+        seq = READ_ONCE(mouse->report_seq);
+        if (wait_event_interruptible(mouse->move_wait,
+                READ_ONCE(mouse->report_seq) != seq || mouse->disconnected))
+            return -ERESTARTSYS;
+    }
+
+    // No more reports will arrive, so stop readers instead of returning the last snapshot forever
+    if (mouse->disconnected)
+        return -ENODEV;
 
-    mutex_lock(&mouse->move_mutex);
+    spin_lock_irqsave(&mouse->move_lock, flags);
     if (!mouse->packet_available) {
-        mutex_unlock(&mouse->move_mutex);
+        spin_unlock_irqrestore(&mouse->move_lock, flags);
         return 0;
     }
 
-    len = snprintf(buffer, sizeof(buffer), "Position: (%d, %d)\nRaw packet: 0x%02x 0x%02x 0x%02x\n", 
+    len = snprintf(buffer, sizeof(buffer), "Position: (%d, %d)\nCursor: (%lld, %lld)\nReport: %llu @ %llu\nRaw packet: 0x%02x 0x%02x 0x%02x\n", 
         mouse->x_pos, mouse->y_pos,
+        mouse->cursor_x >> ACCEL_FP_SHIFT, mouse->cursor_y >> ACCEL_FP_SHIFT,
+        mouse->report_seq, mouse->report_ns,
         mouse->last_packet[0], mouse->last_packet[1], mouse->last_packet[2]);
-    mutex_unlock(&mouse->move_mutex);
+    spin_unlock_irqrestore(&mouse->move_lock, flags);
 
     *ppos = 0;
     return simple_read_from_buffer(buf, count, ppos, buffer, len);
 }
 
-// Accepts "start", "stop" or "reset" commands from userspace.c to control movement tracking
+// Parses a profile command into a copy of the current profile, returns 0 on success, -ENOENT for an
+// unknown keyword and -EINVAL for malformed arguments or trailing text
+static int move_parse_profile(const char *cmd, struct mouse_profile *profile)
+{
+    char keyword[16];
+    int a, b, n;
+
+    if (sscanf(cmd, "%15s%n", keyword, &n) != 1)
+        return -ENOENT;
+    cmd = skip_spaces(cmd + n);
+
+    if (strcmp(keyword, "profile") == 0) {
+        if (sscanf(cmd, "%15s%n", keyword, &n) != 1 || strcmp(keyword, "default") != 0 || *skip_spaces(cmd + n))
+            return -EINVAL;
+        profile_set_default(profile);
+    } else if (strcmp(keyword, "scale") == 0) {
+        if (sscanf(cmd, "%d%n", &a, &n) != 1 || *skip_spaces(cmd + n))
+            return -EINVAL;
+        if (a < 0 || a > 10000)
+            return -EINVAL;
+        profile->scale_pct = a;
+    } else if (strcmp(keyword, "deadzone") == 0) {
+        if (sscanf(cmd, "%d%n", &a, &n) != 1 || *skip_spaces(cmd + n))
+            return -EINVAL;
+        if (a < 0 || a > ACCEL_LUT_SIZE)
+            return -EINVAL;
+        profile->deadzone = a;
+    } else if (strcmp(keyword, "bounds") == 0) {
+        if (sscanf(cmd, "%d %d%n", &a, &b, &n) != 2 || *skip_spaces(cmd + n))
+            return -EINVAL;
+        if (a < 0 || b < 0)
+            return -EINVAL;
+        profile->width = a;
+        profile->height = b;
+    } else if (strcmp(keyword, "curve") == 0) {
+        // Points are "<speed>:<pct>" pairs with strictly increasing speeds, anything else rejects the whole command
+        int count = 0;
+        while (*cmd) {
+            if (sscanf(cmd, "%d:%d%n", &a, &b, &n) != 2)
+                return -EINVAL;
+            if (count == ACCEL_MAX_POINTS || a < 0 || b < 0 || b > 10000)
+                return -EINVAL;
+            if (count > 0 && a <= profile->curve_speed[count - 1])
+                return -EINVAL;
+            profile->curve_speed[count] = a;
+            profile->curve_pct[count] = b;
+            count++;
+            cmd = skip_spaces(cmd + n);
+        }
+        profile->curve_n = count;
+    } else {
+        return -ENOENT;
+    }
+    return 0;
+}
+
+// Accepts "start", "stop" or "reset" commands from userspace.c to control movement tracking,
+// as well as profile commands which rebuild the acceleration table
 static ssize_t move_write(struct file *file, const char __user *buf, size_t count, loff_t *ppos)
 {
     struct usb_mouse *mouse = file->private_data;
-    char buffer[16];
+    char buffer[128];
+    struct mouse_profile profile;
+    unsigned long flags;
+    int ret;
 
     if (count > sizeof(buffer) - 1)
         return -EINVAL;
@@ -208,8 +442,12 @@ static ssize_t move_write(struct file *file, const char __user *buf, size_t coun
     buffer[count] = '\0';
     
     if (strncmp(buffer, "reset", 5) == 0) {
+        spin_lock_irqsave(&mouse->move_lock, flags);
         mouse->x_pos = 0;
         mouse->y_pos = 0;
+        mouse->cursor_x = 0;
+        mouse->cursor_y = 0;
+        spin_unlock_irqrestore(&mouse->move_lock, flags);
         printk(KERN_INFO "[Move] User issued RESET command\n");
     } else if (strncmp(buffer, "stop", 4) == 0) {
         mouse->enabled = false;
@@ -219,7 +457,30 @@ static ssize_t move_write(struct file *file, const char __user *buf, size_t coun
         mouse->enabled = true;
         printk(KERN_INFO "[Move] User issued START command\n");
     } else {
-    printk(KERN_WARNING "[Move] Unknown command received: %s\n", buffer);
+        // config_mutex serialises writers, so profile only changes here and can be read without move_lock.
+        // The table is built outside move_lock so reports are only held up by the copy
+        mutex_lock(&mouse->config_mutex);
+        profile = mouse->profile;
+        ret = move_parse_profile(buffer, &profile);
+        if (ret) {
+            mutex_unlock(&mouse->config_mutex);
+            // Fail the write so configuration scripts notice a profile that was not applied
+            if (ret == -ENOENT)
+                printk(KERN_WARNING "[Move] Unknown command received: %s\n", buffer);
+            else
+                printk(KERN_WARNING "[Move] Invalid profile command: %s\n", buffer);
+            return -EINVAL;
+        }
+        profile_build_lut(&profile, mouse->config_lut);
+
+        spin_lock_irqsave(&mouse->move_lock, flags);
+        mouse->profile = profile;
+        memcpy(mouse->accel_lut, mouse->config_lut, sizeof(mouse->accel_lut));
+        mouse->cursor_x = accel_clamp(mouse->cursor_x, profile.width);
+        mouse->cursor_y = accel_clamp(mouse->cursor_y, profile.height);
+        spin_unlock_irqrestore(&mouse->move_lock, flags);
+        mutex_unlock(&mouse->config_mutex);
+        printk(KERN_INFO "[Move] Profile updated: %s\n", buffer);
     }
     return count;
 }
@@ -229,6 +490,7 @@ static const struct file_operations move_fops = {
     .read = move_read,
     .write = move_write,
     .open = move_open,
+    .release = move_release,
 };
 
 
@@ -260,8 +522,13 @@ static int usb_mouse_connect(struct usb_interface *interface, const struct usb_d
         mouse->pkt_len = 8;
     mouse->enabled = true;
     mouse->disconnected = false;
-    mutex_init(&mouse->move_mutex);
+    spin_lock_init(&mouse->move_lock);
+    mutex_init(&mouse->config_mutex);
+    init_waitqueue_head(&mouse->move_wait);
+    kref_init(&mouse->kref);
     mouse->packet_available = false;
+    profile_set_default(&mouse->profile);
+    profile_build_lut(&mouse->profile, mouse->accel_lut);
 
     mouse->data = usb_alloc_coherent(dev, mouse->pkt_len, GFP_ATOMIC, &mouse->data_dma);
     if (!mouse->data)
@@ -288,11 +555,15 @@ static int usb_mouse_connect(struct usb_interface *interface, const struct usb_d
     if (alloc_chrdev_region(&mouse->click_devt, 0, 1, "usb_mouse_clicks"))
         goto error3;
 
-    cdev_init(&mouse->click_cdev, &click_fops);
-    mouse->click_cdev.owner = THIS_MODULE;
-    if (cdev_add(&mouse->click_cdev, mouse->click_devt, 1))
+    mouse->click_cdev = cdev_alloc();
+    if (!mouse->click_cdev)
         goto error4;
 
+    mouse->click_cdev->ops = &click_fops;
+    mouse->click_cdev->owner = THIS_MODULE;
+    if (cdev_add(mouse->click_cdev, mouse->click_devt, 1))
+        goto error5;
+
     mouse->click_class = class_create("usb_mouse_click_class");
     if (IS_ERR(mouse->click_class))
         goto error5;
@@ -306,11 +577,14 @@ static int usb_mouse_connect(struct usb_interface *interface, const struct usb_d
     if (alloc_chrdev_region(&mouse->move_devt, 0, 1, "usb_mouse_movements"))
         goto error7;
     
-    cdev_init(&mouse->move_cdev, &move_fops);
-
-    mouse->move_cdev.owner = THIS_MODULE;
-    if (cdev_add(&mouse->move_cdev, mouse->move_devt, 1))
+    mouse->move_cdev = cdev_alloc();
+    if (!mouse->move_cdev)
         goto error8;
+
+    mouse->move_cdev->ops = &move_fops;
+    mouse->move_cdev->owner = THIS_MODULE;
+    if (cdev_add(mouse->move_cdev, mouse->move_devt, 1))
+        goto error9;
     
     mouse->move_class = class_create("usb_mouse_move_class");
     if (IS_ERR(mouse->move_class))
@@ -319,20 +593,24 @@ static int usb_mouse_connect(struct usb_interface *interface, const struct usb_d
     mouse->move_device = device_create(mouse->move_class, NULL, mouse->move_devt, NULL, "usb_mouse_movements");
     if (IS_ERR(mouse->move_device))
         goto error10;
+
+    mutex_lock(&mouse_list_mutex);
+    list_add(&mouse->node, &mouse_list);
+    mutex_unlock(&mouse_list_mutex);
     return 0;
 error10: // Failed to create movement char device
     class_destroy(mouse->move_class);
-error9:  //  Failed to create movement class
-    cdev_del(&mouse->move_cdev);
-error8:  // Failed to add movement char device
+error9:  //  Failed to create movement class or add movement char device
+    cdev_del(mouse->move_cdev);
+error8:  // Failed to allocate movement char device
     unregister_chrdev_region(mouse->move_devt, 1);
 error7:  // Failed to allocate movement device number
     device_destroy(mouse->click_class, mouse->click_devt);
 error6:  // Failed to create click char device
     class_destroy(mouse->click_class);
-error5:  // Failed to create click class
-    cdev_del(&mouse->click_cdev);
-error4:  // Failed to add click char device
+error5:  // Failed to create click class or add click char device
+    cdev_del(mouse->click_cdev);
+error4:  // Failed to allocate click char device
     unregister_chrdev_region(mouse->click_devt, 1);
 error3:  // Failed to submit URB
     usb_free_urb(mouse->irq);
@@ -349,21 +627,30 @@ error1:  // Failed to allocate memory for mouse structure
 static void usb_mouse_disconnect(struct usb_interface *interface) {
     struct usb_mouse *mouse = usb_get_intfdata(interface);
 
+    // Unlist first so no new click or movement file can take a reference once teardown starts
+    mutex_lock(&mouse_list_mutex);
+    list_del(&mouse->node);
+    mouse->disconnected = true;
+    mutex_unlock(&mouse_list_mutex);
+
     usb_kill_urb(mouse->irq);
     usb_free_urb(mouse->irq);
     usb_free_coherent(mouse->usbdev, mouse->pkt_len, mouse->data, mouse->data_dma);
 
     device_destroy(mouse->click_class, mouse->click_devt);
     class_destroy(mouse->click_class);
-    cdev_del(&mouse->click_cdev);
+    cdev_del(mouse->click_cdev);
     unregister_chrdev_region(mouse->click_devt, 1);
 
     device_destroy(mouse->move_class, mouse->move_devt);
     class_destroy(mouse->move_class);
-    cdev_del(&mouse->move_cdev);
+    cdev_del(mouse->move_cdev);
     unregister_chrdev_region(mouse->move_devt, 1);
 
-    kfree(mouse);
+    // Wake blocked readers while the interface reference still keeps the mouse alive, they fail with -ENODEV
+    // and the mouse is freed when the last open click or movement file is released
+    wake_up_interruptible(&mouse->move_wait);
+    kref_put(&mouse->kref, usb_mouse_free);
     printk(KERN_INFO "USB Mouse Driver unloaded.\n");
 }
 
@@ -5,7 +5,7 @@ echo "[STEP 1] Compiling kernel module with make..."
 make
 
 echo "[STEP 2] Compiling userspace program..."
-gcc userspace.c -o userprog
+gcc userspace.c -o userprog -pthread
 
 echo "[STEP 3] Please plug in your USB mouse now."
 read -p "Press ENTER once the mouse is connected."
@@ -6,10 +6,20 @@
 #include <termios.h>
 #include <sys/select.h>
 #include <errno.h>
+#include <string.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <time.h>
+#include <poll.h>
+
+#define DASH_FPS          20   // Dashboard redraw rate, independent of the mouse report rate
+#define DASH_HIST_BUCKETS 8    // Buckets in the report-rate and latency histograms
+#define DASH_BAR_WIDTH    40   // Maximum histogram bar length in characters
 
 void movement_tracker_menu(void);
 void set_raw_mode(int enable);
 void click_logger(void);
+void dashboard(void);
 
 
 int main() {
@@ -21,14 +31,15 @@ int main() {
         printf("----- USB Mouse Driver Menu -----\n");
         printf("1. Click Counter\n");
         printf("2. Movement Tracker\n");
-        printf("3. Disconnect Mouse\n");
-        printf("4. Exit\n");
+        printf("3. Live Dashboard\n");
+        printf("4. Disconnect Mouse\n");
+        printf("5. Exit\n");
         printf("Please enter your choice: ");
 
         // Invalid user input handling
         if (scanf("%d", &user_choice) != 1) {
 
-            printf("Invalid input. Please enter a number between 1-4!\n");
+            printf("Invalid input. Please enter a number between 1-5!\n");
 
             while (getchar() != '\n');
 
@@ -46,6 +57,10 @@ int main() {
                 break;
             
             case 3:
+                dashboard();
+                break;
+
+            case 4:
                 const char *devices[] = {
                 "/dev/usb_mouse_movements",
                 "/dev/usb_mouse_clicks"
@@ -68,12 +83,12 @@ int main() {
                 printf("Mouse disconnected successfully.\n");
                 exit(0);
 
-            case 4:
+            case 5:
                 printf("Exiting USB Mouse Driver Menu...\n");
                 exit(0);
 
             default:
-            printf("Invalid input. Please enter a number between 1-3!\n");   
+            printf("Invalid input. Please enter a number between 1-5!\n");   
         }
     }
     return 0;
@@ -185,7 +200,7 @@ void movement_tracker_menu() {
     }
 
     int tracking_enabled = 0;  // Flag for tracking mode (0: not tracking, 1: tracking enabled)
-    signed char buffer[128];    // Buffer to store mouse movement data
+    signed char buffer[256];    // Buffer to store mouse movement data
 
     setvbuf(stdout, NULL, _IONBF, 0);  // Disable buffering for stdout
     printf("Movement tracker initialized.\n");
@@ -281,3 +296,338 @@ void movement_tracker_menu() {
 
     close(file_descriptor);  // Close device file before exiting
 }
+
+
+// --- live dashboard
+// Upper bounds of each histogram bucket, the last bucket catches everything above.
+// Report rate buckets are centred on the standard polling rates, with bounds at the geometric midpoints between them
+static const uint64_t rate_bounds_hz[DASH_HIST_BUCKETS] = {88, 177, 354, 707, 1414, 2828, 5657, UINT64_MAX};
+static const char *rate_labels[DASH_HIST_BUCKETS] = {"<88 Hz", "~125 Hz", "~250 Hz", "~500 Hz", "~1 kHz", "~2 kHz", "~4 kHz", ">=5.7 kHz"};
+static const uint64_t latency_bounds_us[DASH_HIST_BUCKETS] = {50, 100, 250, 500, 1000, 2000, 5000, UINT64_MAX};
+static const char *latency_labels[DASH_HIST_BUCKETS] = {"<50 us", "<100 us", "<250 us", "<500 us", "<1 ms", "<2 ms", "<5 ms", ">=5 ms"};
+
+// Statistics gathered by the event reader thread
+struct dashboard_stats {
+    int x_pos, y_pos;
+    long long cursor_x, cursor_y;
+    uint64_t report_seq;
+    uint64_t report_ns;
+    uint64_t rate_hist[DASH_HIST_BUCKETS];
+    uint64_t latency_hist[DASH_HIST_BUCKETS];
+    int read_error;
+};
+
+// State shared between the event reader thread and the render loop, stats are protected by lock
+struct dashboard_state {
+    pthread_mutex_t lock;
+    int fd;
+    struct dashboard_stats stats;
+};
+
+// Screen cells that are redrawn only when their text changes
+enum {
+    CELL_POSITION,
+    CELL_CURSOR,
+    CELL_VELOCITY,
+    CELL_CLICKS,
+    CELL_REPORTS,
+    CELL_RATE_HIST,
+    CELL_LATENCY_HIST = CELL_RATE_HIST + DASH_HIST_BUCKETS,
+    CELL_STATUS = CELL_LATENCY_HIST + DASH_HIST_BUCKETS,
+    CELL_COUNT
+};
+
+struct dashboard_cell {
+    int row, col;
+    char text[96];      // Text currently on screen
+    char next[96];      // Text queued in the frame buffer, becomes text once the frame is written
+    int pending;
+};
+
+static uint64_t monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static int bucket_index(uint64_t value, const uint64_t *bounds) {
+    int i;
+    for (i = 0; i < DASH_HIST_BUCKETS - 1; i++) {
+        if (value < bounds[i])
+            break;
+    }
+    return i;
+}
+
+// Event reader thread: blocking reads return once per new report, so this consumes the stream as fast as
+// the driver produces it. Reports that arrive between two reads are accounted for by the sequence number.
+static void *dashboard_reader(void *arg) {
+    struct dashboard_state *state = arg;
+    struct dashboard_stats *stats = &state->stats;
+    char buffer[256];
+    uint64_t prev_seq = 0, prev_ns = 0;
+
+    while (1) {
+        ssize_t bytes_read = read(state->fd, buffer, sizeof(buffer) - 1);
+        uint64_t now = monotonic_ns();
+        if (bytes_read < 0 && errno == EINTR)
+            continue;
+        if (bytes_read <= 0) {
+            pthread_mutex_lock(&state->lock);
+            stats->read_error = bytes_read < 0 ? errno : ENODEV;
+            pthread_mutex_unlock(&state->lock);
+            return NULL;
+        }
+        buffer[bytes_read] = '\0';
+
+        int x, y;
+        long long cx, cy;
+        uint64_t seq, ns;
+        if (sscanf(buffer, "Position: (%d, %d)\nCursor: (%lld, %lld)\nReport: %" SCNu64 " @ %" SCNu64,
+                   &x, &y, &cx, &cy, &seq, &ns) != 6)
+            continue;
+
+        pthread_mutex_lock(&state->lock);
+        stats->x_pos = x;
+        stats->y_pos = y;
+        stats->cursor_x = cx;
+        stats->cursor_y = cy;
+        stats->report_seq = seq;
+        stats->report_ns = ns;
+        // Average interval over any coalesced reports gives their rate, counted once per report
+        if (prev_ns != 0 && seq > prev_seq && ns > prev_ns) {
+            uint64_t interval = (ns - prev_ns) / (seq - prev_seq);
+            uint64_t rate = interval ? 1000000000ull / interval : UINT64_MAX;
+            stats->rate_hist[bucket_index(rate, rate_bounds_hz)] += seq - prev_seq;
+        }
+        if (now >= ns)
+            stats->latency_hist[bucket_index((now - ns) / 1000, latency_bounds_us)]++;
+        pthread_mutex_unlock(&state->lock);
+
+        prev_seq = seq;
+        prev_ns = ns;
+    }
+}
+
+// Writes a whole buffer, waiting for the fd to drain when it is non-blocking (stdin and stdout share one
+// file description on a tty, so raw mode also makes stdout non-blocking). Returns -1 on error
+static int write_all(int fd, const char *buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, buf, len);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                struct pollfd pfd = {fd, POLLOUT, 0};
+                poll(&pfd, 1, -1);
+                continue;
+            }
+            return -1;
+        }
+        buf += n;
+        len -= n;
+    }
+    return 0;
+}
+
+// Appends a cursor-addressed update for a cell to the frame buffer if its text changed.
+// The cell only records the new text once dashboard_cells_commit confirms the frame was written
+static void dashboard_cell_update(struct dashboard_cell *cell, const char *text, char *frame, size_t *len, size_t size) {
+    if (strcmp(cell->text, text) == 0)
+        return;
+    int n = snprintf(frame + *len, size - *len, "\033[%d;%dH%s\033[K", cell->row, cell->col, text);
+    if (n < 0 || (size_t)n >= size - *len) {
+        frame[*len] = '\0';  // No room left, the cell is retried next frame
+        return;
+    }
+    *len += n;
+    snprintf(cell->next, sizeof(cell->next), "%s", text);
+    cell->pending = 1;
+}
+
+// Marks queued cells as drawn if the frame was written, otherwise leaves them to be redrawn next frame
+static void dashboard_cells_commit(struct dashboard_cell *cells, int written) {
+    for (int i = 0; i < CELL_COUNT; i++) {
+        if (cells[i].pending && written)
+            memcpy(cells[i].text, cells[i].next, sizeof(cells[i].text));
+        cells[i].pending = 0;
+    }
+}
+
+// Renders one histogram bucket as a bar scaled against the largest bucket
+static void dashboard_format_bar(char *text, size_t size, uint64_t count, uint64_t max) {
+    char bar[DASH_BAR_WIDTH + 1];
+    int width = max ? (int)(count * DASH_BAR_WIDTH / max) : 0;
+    memset(bar, '#', width);
+    bar[width] = '\0';
+    snprintf(text, size, "%-*s %" PRIu64, DASH_BAR_WIDTH, bar, count);
+}
+
+// Functionality: Live dashboard showing position, velocity, click rate and report-rate / latency histograms.
+// Events are consumed on a reader thread while this loop redraws changed cells at a fixed frame rate.
+void dashboard() {
+    struct dashboard_state state;
+    struct dashboard_cell cells[CELL_COUNT];
+    pthread_t reader;
+    char frame[8192];
+    char text[96];
+    size_t len;
+    int i;
+
+    memset(&state, 0, sizeof(state));
+    pthread_mutex_init(&state.lock, NULL);
+    state.fd = open("/dev/usb_mouse_movements", O_RDWR);
+    if (state.fd < 0) {
+        perror("Failed to open /dev/usb_mouse_movements");
+        return;
+    }
+    int click_fd = open("/dev/usb_mouse_clicks", O_RDONLY);
+    if (write(state.fd, "start", 5) < 0)
+        perror("Failed to start movement tracking");
+
+    if (pthread_create(&reader, NULL, dashboard_reader, &state) != 0) {
+        perror("Failed to start event reader");
+        close(click_fd);
+        close(state.fd);
+        return;
+    }
+
+    // Static layout: labels are drawn once, values live in cells
+    memset(cells, 0, sizeof(cells));
+    cells[CELL_POSITION] = (struct dashboard_cell){3, 15};
+    cells[CELL_CURSOR] = (struct dashboard_cell){4, 15};
+    cells[CELL_VELOCITY] = (struct dashboard_cell){5, 15};
+    cells[CELL_CLICKS] = (struct dashboard_cell){6, 15};
+    cells[CELL_REPORTS] = (struct dashboard_cell){7, 15};
+    for (i = 0; i < DASH_HIST_BUCKETS; i++) {
+        cells[CELL_RATE_HIST + i] = (struct dashboard_cell){10 + i, 13};
+        cells[CELL_LATENCY_HIST + i] = (struct dashboard_cell){20 + i, 13};
+    }
+    cells[CELL_STATUS] = (struct dashboard_cell){29, 1};
+
+    len = snprintf(frame, sizeof(frame),
+                   "\033[?25l\033[2J\033[1;1H----- USB Mouse Live Dashboard ----- (press 'q' to quit)"
+                   "\033[3;1HPosition:\033[4;1HCursor:\033[5;1HVelocity:\033[6;1HClick rate:\033[7;1HReports:"
+                   "\033[9;1HReport rate histogram\033[19;1HLatency histogram");
+    for (i = 0; i < DASH_HIST_BUCKETS; i++) {
+        len += snprintf(frame + len, sizeof(frame) - len, "\033[%d;1H%10s \033[%d;1H%10s ",
+                        10 + i, rate_labels[i], 20 + i, latency_labels[i]);
+    }
+    if (write_all(STDOUT_FILENO, frame, len) < 0)
+        perror("Failed to draw dashboard");
+
+    set_raw_mode(1);
+
+    uint64_t frame_ns = 1000000000ull / DASH_FPS;
+    uint64_t prev_frame = monotonic_ns();
+    uint64_t prev_seq = 0, click_window_start = prev_frame;
+    int prev_x = 0, prev_y = 0, have_prev = 0;
+    int click_count = -1, window_clicks = -1;
+    double velocity_x = 0, velocity_y = 0, click_rate = 0, report_rate = 0;
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+    while (1) {
+        // Sleep until the next frame boundary so rendering cost does not depend on the event rate
+        deadline.tv_nsec += frame_ns;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL);
+
+        char ch;
+        if (read(STDIN_FILENO, &ch, 1) > 0 && (ch == 'q' || ch == 'Q'))
+            break;
+
+        struct dashboard_stats snap;
+        pthread_mutex_lock(&state.lock);
+        snap = state.stats;
+        pthread_mutex_unlock(&state.lock);
+
+        if (click_fd >= 0) {
+            char buffer[64];
+            lseek(click_fd, 0, SEEK_SET);
+            int n = read(click_fd, buffer, sizeof(buffer) - 1);
+            if (n > 0) {
+                buffer[n] = '\0';
+                sscanf(buffer, "Click count: %d", &click_count);
+            }
+        }
+
+        // Velocity and rates are measured per frame rather than per report
+        uint64_t now = monotonic_ns();
+        double dt = (now - prev_frame) / 1e9;
+        if (have_prev && dt > 0) {
+            velocity_x = (snap.x_pos - prev_x) / dt;
+            velocity_y = (snap.y_pos - prev_y) / dt;
+            report_rate = (snap.report_seq - prev_seq) / dt;
+        }
+        prev_x = snap.x_pos;
+        prev_y = snap.y_pos;
+        prev_seq = snap.report_seq;
+        prev_frame = now;
+        have_prev = 1;
+        if (window_clicks < 0 || click_count < window_clicks) {
+            window_clicks = click_count;
+            click_window_start = now;
+        } else if (now - click_window_start >= 1000000000ull) {
+            click_rate = (click_count - window_clicks) * 1e9 / (now - click_window_start);
+            window_clicks = click_count;
+            click_window_start = now;
+        }
+
+        len = 0;
+        snprintf(text, sizeof(text), "(%d, %d)", snap.x_pos, snap.y_pos);
+        dashboard_cell_update(&cells[CELL_POSITION], text, frame, &len, sizeof(frame));
+        snprintf(text, sizeof(text), "(%lld, %lld)", snap.cursor_x, snap.cursor_y);
+        dashboard_cell_update(&cells[CELL_CURSOR], text, frame, &len, sizeof(frame));
+        snprintf(text, sizeof(text), "(%.0f, %.0f) counts/s", velocity_x, velocity_y);
+        dashboard_cell_update(&cells[CELL_VELOCITY], text, frame, &len, sizeof(frame));
+        if (click_count >= 0)
+            snprintf(text, sizeof(text), "%.1f clicks/s (total %d)", click_rate, click_count);
+        else
+            snprintf(text, sizeof(text), "n/a");
+        dashboard_cell_update(&cells[CELL_CLICKS], text, frame, &len, sizeof(frame));
+        snprintf(text, sizeof(text), "%" PRIu64 " (%.0f Hz)", snap.report_seq, report_rate);
+        dashboard_cell_update(&cells[CELL_REPORTS], text, frame, &len, sizeof(frame));
+
+        uint64_t rate_max = 0, latency_max = 0;
+        for (i = 0; i < DASH_HIST_BUCKETS; i++) {
+            if (snap.rate_hist[i] > rate_max)
+                rate_max = snap.rate_hist[i];
+            if (snap.latency_hist[i] > latency_max)
+                latency_max = snap.latency_hist[i];
+        }
+        for (i = 0; i < DASH_HIST_BUCKETS; i++) {
+            dashboard_format_bar(text, sizeof(text), snap.rate_hist[i], rate_max);
+            dashboard_cell_update(&cells[CELL_RATE_HIST + i], text, frame, &len, sizeof(frame));
+            dashboard_format_bar(text, sizeof(text), snap.latency_hist[i], latency_max);
+            dashboard_cell_update(&cells[CELL_LATENCY_HIST + i], text, frame, &len, sizeof(frame));
+        }
+
+        if (snap.read_error)
+            snprintf(text, sizeof(text), "Read error: %s", strerror(snap.read_error));
+        else
+            text[0] = '\0';
+        dashboard_cell_update(&cells[CELL_STATUS], text, frame, &len, sizeof(frame));
+
+        if (len > 0)
+            dashboard_cells_commit(cells, write_all(STDOUT_FILENO, frame, len) == 0);
+    }
+
+    // Reader is parked in a blocking read, which is a cancellation point
+    pthread_cancel(reader);
+    pthread_join(reader, NULL);
+    pthread_mutex_destroy(&state.lock);
+
+    set_raw_mode(0);
+    len = snprintf(frame, sizeof(frame), "\033[%d;1H\033[?25h\n", cells[CELL_STATUS].row + 1);
+    if (write_all(STDOUT_FILENO, frame, len) < 0)
+        perror("Failed to restore terminal");
+    printf("Dashboard closed.\n");
+
+    if (click_fd >= 0)
+        close(click_fd);
+    close(state.fd);
+}